@@ -16,6 +16,7 @@
  */
 
 #include "events/mbed_shared_queues.h"
+#include "events/EventQueue.h"
 
 using namespace events;
 
@@ -70,7 +70,7 @@ public:
             _event->post = &Event::event_post<F>;
             _event->dtor = &Event::event_dtor<F>;
 
-            new (_event + 1) F(f);
+            new (_event + 1) F(std::move(f));
 
             _event->ref = 1;
         }
@@ -220,6 +220,12 @@ private:
     } *_event;
 
     // Event attributes
+    //
+    // The bound callable was composed once when the Event was created
+    // and lives after the event struct, posting only copy-constructs
+    // that snapshot plus the call arguments into the queue. For the
+    // trivially copyable bindings that dominate, the copy constructor
+    // lowers to a word-aligned block copy
     template <typename F>
     static int event_post(struct event *e, ArgTs... args)
     {
@@ -232,7 +238,9 @@ private:
         new (p) C(*(F *)(e + 1), args...);
         equeue_event_delay(p, e->delay);
         equeue_event_period(p, e->period);
-        equeue_event_dtor(p, &EventQueue::function_dtor<C>);
+        if (!std::is_trivially_destructible<C>::value) {
+            equeue_event_dtor(p, &EventQueue::function_dtor<C>);
+        }
         return equeue_post(e->equeue, &EventQueue::function_call<C>, p);
     }
 
@@ -253,7 +261,7 @@ public:
      */
     template <typename F, typename... ContextArgTs>
     Event(EventQueue *q, F f, ContextArgTs... context_args) :
-        Event(q, EventQueue::context<F, ContextArgTs...>(f, context_args...)) { }
+        Event(q, EventQueue::context<F, ContextArgTs...>(std::move(f), std::move(context_args)...)) { }
 
     /** Create an event
      *  @see Event::Event
@@ -401,221 +409,41 @@ public:
 
 // Convenience functions declared here to avoid cyclic
 // dependency between Event and EventQueue
-template <typename R, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(R(*func)(ArgTs...))
-{
-    return Event<void(ArgTs...)>(this, func);
-}
-
-template <typename T, typename R, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(T *obj, R(T::*method)(ArgTs...))
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method));
-}
-
-template <typename T, typename R, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const T *obj, R(T::*method)(ArgTs...) const)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method));
-}
-
-template <typename T, typename R, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(volatile T *obj, R(T::*method)(ArgTs...) volatile)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method));
-}
-
-template <typename T, typename R, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const volatile T *obj, R(T::*method)(ArgTs...) const volatile)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method));
-}
-
-template <typename R, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(mbed::Callback<R(ArgTs...)> cb)
-{
-    return Event<void(ArgTs...)>(this, cb);
-}
-
-template <typename R, typename B0, typename C0, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(R(*func)(B0, ArgTs...), C0 c0)
-{
-    return Event<void(ArgTs...)>(this, func, c0);
-}
-
-template <typename T, typename R, typename B0, typename C0, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(T *obj, R(T::*method)(B0, ArgTs...), C0 c0)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0);
-}
-
-template <typename T, typename R, typename B0, typename C0, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const T *obj, R(T::*method)(B0, ArgTs...) const, C0 c0)
+template <typename R, typename... Ps, typename... Cs>
+Event<typename EventQueue::drop_args<sizeof...(Cs), void(Ps...)>::type>
+EventQueue::event(R(*func)(Ps...), Cs... context_args)
 {
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0);
+    using signature = typename drop_args<sizeof...(Cs), void(Ps...)>::type;
+    return Event<signature>(this, func, std::move(context_args)...);
 }
 
-template <typename T, typename R, typename B0, typename C0, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(volatile T *obj, R(T::*method)(B0, ArgTs...) volatile, C0 c0)
+template <typename T, typename M, typename... Cs,
+          typename std::enable_if<std::is_member_function_pointer<M>::value, int>::type>
+Event<typename EventQueue::template drop_args<sizeof...(Cs), typename EventQueue::template member_params<M>::type>::type>
+EventQueue::event(T *obj, M method, Cs... context_args)
 {
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0);
+    // Bind through mcall rather than an intermediate mbed::Callback,
+    // the stored binding is just the object and method pointers and
+    // dispatch is a direct pointer-to-member call
+    using signature = typename drop_args<sizeof...(Cs), typename member_params<M>::type>::type;
+    return Event<signature>(this, mcall<T, M>(obj, method), std::move(context_args)...);
 }
 
-template <typename T, typename R, typename B0, typename C0, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const volatile T *obj, R(T::*method)(B0, ArgTs...) const volatile, C0 c0)
+template <typename R, typename... Ps, typename... Cs>
+Event<typename EventQueue::drop_args<sizeof...(Cs), void(Ps...)>::type>
+EventQueue::event(mbed::Callback<R(Ps...)> cb, Cs... context_args)
 {
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0);
+    // The Callback is moved rather than copied into the Event, its bound
+    // target can be several words on Cortex-M
+    using signature = typename drop_args<sizeof...(Cs), void(Ps...)>::type;
+    return Event<signature>(this, std::move(cb), std::move(context_args)...);
 }
 
-template <typename R, typename B0, typename C0, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(mbed::Callback<R(B0, ArgTs...)> cb, C0 c0)
-{
-    return Event<void(ArgTs...)>(this, cb, c0);
-}
-
-template <typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(R(*func)(B0, B1, ArgTs...), C0 c0, C1 c1)
-{
-    return Event<void(ArgTs...)>(this, func, c0, c1);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(T *obj, R(T::*method)(B0, B1, ArgTs...), C0 c0, C1 c1)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const T *obj, R(T::*method)(B0, B1, ArgTs...) const, C0 c0, C1 c1)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(volatile T *obj, R(T::*method)(B0, B1, ArgTs...) volatile, C0 c0, C1 c1)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const volatile T *obj, R(T::*method)(B0, B1, ArgTs...) const volatile, C0 c0, C1 c1)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1);
-}
-
-template <typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(mbed::Callback<R(B0, B1, ArgTs...)> cb, C0 c0, C1 c1)
-{
-    return Event<void(ArgTs...)>(this, cb, c0, c1);
-}
-
-template <typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(R(*func)(B0, B1, B2, ArgTs...), C0 c0, C1 c1, C2 c2)
-{
-    return Event<void(ArgTs...)>(this, func, c0, c1, c2);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(T *obj, R(T::*method)(B0, B1, B2, ArgTs...), C0 c0, C1 c1, C2 c2)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const T *obj, R(T::*method)(B0, B1, B2, ArgTs...) const, C0 c0, C1 c1, C2 c2)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(volatile T *obj, R(T::*method)(B0, B1, B2, ArgTs...) volatile, C0 c0, C1 c1, C2 c2)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const volatile T *obj, R(T::*method)(B0, B1, B2, ArgTs...) const volatile, C0 c0, C1 c1, C2 c2)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2);
-}
-
-template <typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(mbed::Callback<R(B0, B1, B2, ArgTs...)> cb, C0 c0, C1 c1, C2 c2)
-{
-    return Event<void(ArgTs...)>(this, cb, c0, c1, c2);
-}
-
-template <typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(R(*func)(B0, B1, B2, B3, ArgTs...), C0 c0, C1 c1, C2 c2, C3 c3)
-{
-    return Event<void(ArgTs...)>(this, func, c0, c1, c2, c3);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(T *obj, R(T::*method)(B0, B1, B2, B3, ArgTs...), C0 c0, C1 c1, C2 c2, C3 c3)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2, c3);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const T *obj, R(T::*method)(B0, B1, B2, B3, ArgTs...) const, C0 c0, C1 c1, C2 c2, C3 c3)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2, c3);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(volatile T *obj, R(T::*method)(B0, B1, B2, B3, ArgTs...) volatile, C0 c0, C1 c1, C2 c2, C3 c3)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2, c3);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const volatile T *obj, R(T::*method)(B0, B1, B2, B3, ArgTs...) const volatile, C0 c0, C1 c1, C2 c2, C3 c3)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2, c3);
-}
-
-template <typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(mbed::Callback<R(B0, B1, B2, B3, ArgTs...)> cb, C0 c0, C1 c1, C2 c2, C3 c3)
-{
-    return Event<void(ArgTs...)>(this, cb, c0, c1, c2, c3);
-}
-
-template <typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(R(*func)(B0, B1, B2, B3, B4, ArgTs...), C0 c0, C1 c1, C2 c2, C3 c3, C4 c4)
-{
-    return Event<void(ArgTs...)>(this, func, c0, c1, c2, c3, c4);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(T *obj, R(T::*method)(B0, B1, B2, B3, B4, ArgTs...), C0 c0, C1 c1, C2 c2, C3 c3, C4 c4)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2, c3, c4);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const T *obj, R(T::*method)(B0, B1, B2, B3, B4, ArgTs...) const, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2, c3, c4);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(volatile T *obj, R(T::*method)(B0, B1, B2, B3, B4, ArgTs...) volatile, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2, c3, c4);
-}
-
-template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(const volatile T *obj, R(T::*method)(B0, B1, B2, B3, B4, ArgTs...) const volatile, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4)
-{
-    return Event<void(ArgTs...)>(this, mbed::callback(obj, method), c0, c1, c2, c3, c4);
-}
-
-template <typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-Event<void(ArgTs...)> EventQueue::event(mbed::Callback<R(B0, B1, B2, B3, B4, ArgTs...)> cb, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4)
-{
-    return Event<void(ArgTs...)>(this, cb, c0, c1, c2, c3, c4);
-}
+// The no-argument and single-int event shapes cover the bulk of uses,
+// their non-template members are instantiated once in the events
+// library rather than in every including translation unit
+extern template class Event<void()>;
+extern template class Event<void(int)>;
 
 /** @}*/
 }
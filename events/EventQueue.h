@@ -21,8 +21,12 @@
 #include "events/equeue.h"
 #include "platform/Callback.h"
 #include "platform/NonCopyable.h"
+#include "platform/mbed_toolchain.h"
 #include <cstddef>
 #include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace events {
 /**
@@ -597,6 +601,24 @@ public:
     template <typename R, typename ...BoundArgs, typename ...ContextArgs, typename ...Args>
     Event<void(Args...)> event(mbed::Callback<R(BoundArgs..., Args...)> cb, ContextArgs ...context_args);
 
+    /** Calculates the buffer space a posted event takes
+     *
+     *  Returns the number of bytes an event binding a callable of type F
+     *  and the given context argument types consumes from the queue's
+     *  buffer, including the event header and the allocator's rounding
+     *  of the payload to its power-of-two size class.
+     *
+     *  Useful for sizing a queue's buffer at compile time, or for a
+     *  static_assert that a binding still fits EVENTS_EVENT_SIZE and
+     *  doesn't silently spill into a larger size class. Bindings too
+     *  large to be sensible in the buffer are better served by
+     *  UserAllocatedEvent.
+     *
+     *  @return     Bytes of queue buffer consumed per posted event
+     */
+    template <typename F, typename... ContextArgTs>
+    static constexpr size_t event_size();
+
 #else
 
     /** Calls an event on the queue
@@ -638,57 +660,61 @@ public:
             return 0;
         }
 
-        F *e = new (p) F(f);
-        equeue_event_dtor(e, &EventQueue::function_dtor<F>);
+        F *e = new (p) F(std::move(f));
+        if (!std::is_trivially_destructible<F>::value) {
+            equeue_event_dtor(e, &EventQueue::function_dtor<F>);
+        }
         return equeue_post(&_equeue, &EventQueue::function_call<F>, e);
     }
 
-
     /** Calls an event on the queue
+     *
+     *  Exact-match overload for a C-style callback and opaque argument.
+     *  Posts through the underlying equeue call directly, sharing its
+     *  single dispatch thunk instead of instantiating one per callable
      *  @see                    EventQueue::call
-     *  @param f                Function to execute in the context of the dispatch loop
-     *  @param args             Arguments to pass to the callback
-     */
-    template <typename F, typename... ArgTs>
-    int call(F f, ArgTs... args)
-    {
-        return call(context<F, ArgTs...>(f, args...));
-    }
-
-    /** Calls an event on the queue
-     *  @see EventQueue::call
+     *  @param func             Function to execute in the context of the dispatch loop
+     *  @param arg              Argument to pass to the callback
      */
-    template <typename T, typename R, typename... ArgTs>
-    int call(T *obj, R(T::*method)(ArgTs...), ArgTs... args)
+    int call(void (*func)(void *), void *arg)
     {
-        return call(mbed::callback(obj, method), args...);
+        return equeue_call(&_equeue, func, arg);
     }
 
     /** Calls an event on the queue
-     *  @see EventQueue::call
+     *  @see                    EventQueue::call
+     *  @param f                Function to execute in the context of the dispatch loop
+     *  @param args             Arguments to pass to the callback
      */
-    template <typename T, typename R, typename... ArgTs>
-    int call(const T *obj, R(T::*method)(ArgTs...) const, ArgTs... args)
+    template <typename F, typename... ArgTs>
+    int call(F f, ArgTs... args)
     {
-        return call(mbed::callback(obj, method), args...);
-    }
+        // construct the bound call directly in queue memory, skipping
+        // the stack temporary a delegating call(context(...)) would copy
+        typedef context<F, ArgTs...> C;
+        void *p = equeue_alloc(&_equeue, sizeof(C));
+        if (!p) {
+            return 0;
+        }
 
-    /** Calls an event on the queue
-     *  @see EventQueue::call
-     */
-    template <typename T, typename R, typename... ArgTs>
-    int call(volatile T *obj, R(T::*method)(ArgTs...) volatile, ArgTs... args)
-    {
-        return call(mbed::callback(obj, method), args...);
+        C *e = new (p) C(std::move(f), std::move(args)...);
+        if (!std::is_trivially_destructible<C>::value) {
+            equeue_event_dtor(e, &EventQueue::function_dtor<C>);
+        }
+        return equeue_post(&_equeue, &EventQueue::function_call<C>, e);
     }
 
     /** Calls an event on the queue
+     *
+     *  The deduced object type carries any cv-qualification, so a single
+     *  template covers the const/volatile method overload matrix
      *  @see EventQueue::call
      */
-    template <typename T, typename R, typename... ArgTs>
-    int call(const volatile T *obj, R(T::*method)(ArgTs...) const volatile, ArgTs... args)
+    template <typename T, typename M, typename... ArgTs,
+              typename std::enable_if<std::is_member_function_pointer<M>::value, int>::type = 0>
+    int call(T *obj, M method, ArgTs... args)
     {
-        return call(mbed::callback(obj, method), args...);
+        return call(mcall<T, M>(obj, method), args...);
     }
 
     /** Calls an event on the queue after a specified delay
@@ -713,58 +739,56 @@ public:
             return 0;
         }
 
-        F *e = new (p) F(f);
+        F *e = new (p) F(std::move(f));
         equeue_event_delay(e, ms);
-        equeue_event_dtor(e, &EventQueue::function_dtor<F>);
+        if (!std::is_trivially_destructible<F>::value) {
+            equeue_event_dtor(e, &EventQueue::function_dtor<F>);
+        }
         return equeue_post(&_equeue, &EventQueue::function_call<F>, e);
     }
 
     /** Calls an event on the queue after a specified delay
      *  @see                        EventQueue::call_in
      *  @param ms                   Time to delay in milliseconds
-     *  @param f                    Function to execute in the context of the dispatch loop
-     *  @param args                 Arguments to pass to the callback
+     *  @param func                 Function to execute in the context of the dispatch loop
+     *  @param arg                  Argument to pass to the callback
      */
-    template <typename F, typename... ArgTs>
-    int call_in(int ms, F f, ArgTs... args)
+    int call_in(int ms, void (*func)(void *), void *arg)
     {
-        return call_in(ms, context<F, ArgTs...>(f, args...));
+        return equeue_call_in(&_equeue, ms, func, arg);
     }
 
     /** Calls an event on the queue after a specified delay
-     *  @see EventQueue::call_in
-     */
-    template <typename T, typename R, typename... ArgTs>
-    int call_in(int ms, T *obj, R(T::*method)(ArgTs...), ArgTs... args)
-    {
-        return call_in(ms, mbed::callback(obj, method), args...);
-    }
-
-    /** Calls an event on the queue after a specified delay
-     *  @see EventQueue::call_in
+     *  @see                        EventQueue::call_in
+     *  @param ms                   Time to delay in milliseconds
+     *  @param f                    Function to execute in the context of the dispatch loop
+     *  @param args                 Arguments to pass to the callback
      */
-    template <typename T, typename R, typename... ArgTs>
-    int call_in(int ms, const T *obj, R(T::*method)(ArgTs...) const, ArgTs... args)
+    template <typename F, typename... ArgTs>
+    int call_in(int ms, F f, ArgTs... args)
     {
-        return call_in(ms, mbed::callback(obj, method), args...);
-    }
+        typedef context<F, ArgTs...> C;
+        void *p = equeue_alloc(&_equeue, sizeof(C));
+        if (!p) {
+            return 0;
+        }
 
-    /** Calls an event on the queue after a specified delay
-     *  @see EventQueue::call_in
-     */
-    template <typename T, typename R, typename... ArgTs>
-    int call_in(int ms, volatile T *obj, R(T::*method)(ArgTs...) volatile, ArgTs... args)
-    {
-        return call_in(ms, mbed::callback(obj, method), args...);
+        C *e = new (p) C(std::move(f), std::move(args)...);
+        equeue_event_delay(e, ms);
+        if (!std::is_trivially_destructible<C>::value) {
+            equeue_event_dtor(e, &EventQueue::function_dtor<C>);
+        }
+        return equeue_post(&_equeue, &EventQueue::function_call<C>, e);
     }
 
     /** Calls an event on the queue after a specified delay
      *  @see EventQueue::call_in
      */
-    template <typename T, typename R, typename... ArgTs>
-    int call_in(int ms, const volatile T *obj, R(T::*method)(ArgTs...) const volatile, ArgTs... args)
+    template <typename T, typename M, typename... ArgTs,
+              typename std::enable_if<std::is_member_function_pointer<M>::value, int>::type = 0>
+    int call_in(int ms, T *obj, M method, ArgTs... args)
     {
-        return call_in(ms, mbed::callback(obj, method), args...);
+        return call_in(ms, mcall<T, M>(obj, method), args...);
     }
 
     /** Calls an event on the queue periodically
@@ -792,292 +816,173 @@ public:
             return 0;
         }
 
-        F *e = new (p) F(f);
+        F *e = new (p) F(std::move(f));
         equeue_event_delay(e, ms);
         equeue_event_period(e, ms);
-        equeue_event_dtor(e, &EventQueue::function_dtor<F>);
+        if (!std::is_trivially_destructible<F>::value) {
+            equeue_event_dtor(e, &EventQueue::function_dtor<F>);
+        }
         return equeue_post(&_equeue, &EventQueue::function_call<F>, e);
     }
 
     /** Calls an event on the queue periodically
      *  @see                    EventQueue::call_every
-     *  @param f                Function to execute in the context of the dispatch loop
-     *  @param args             Arguments to pass to the callback
      *  @param ms               Period of the event in milliseconds
+     *  @param func             Function to execute in the context of the dispatch loop
+     *  @param arg              Argument to pass to the callback
      */
-    template <typename F, typename... ArgTs>
-    int call_every(int ms, F f, ArgTs... args)
+    int call_every(int ms, void (*func)(void *), void *arg)
     {
-        return call_every(ms, context<F, ArgTs...>(f, args...));
+        return equeue_call_every(&_equeue, ms, func, arg);
     }
 
     /** Calls an event on the queue periodically
-     *  @see EventQueue::call_every
+     *  @see                    EventQueue::call_every
+     *  @param f                Function to execute in the context of the dispatch loop
+     *  @param args             Arguments to pass to the callback
+     *  @param ms               Period of the event in milliseconds
      */
-    template <typename T, typename R, typename... ArgTs>
-    int call_every(int ms, T *obj, R(T::*method)(ArgTs...), ArgTs... args)
+    template <typename F, typename... ArgTs>
+    int call_every(int ms, F f, ArgTs... args)
     {
-        return call_every(ms, mbed::callback(obj, method), args...);
-    }
+        typedef context<F, ArgTs...> C;
+        void *p = equeue_alloc(&_equeue, sizeof(C));
+        if (!p) {
+            return 0;
+        }
 
-    /** Calls an event on the queue periodically
-     *  @see EventQueue::call_every
-     */
-    template <typename T, typename R, typename... ArgTs>
-    int call_every(int ms, const T *obj, R(T::*method)(ArgTs...) const, ArgTs... args)
-    {
-        return call_every(ms, mbed::callback(obj, method), args...);
+        C *e = new (p) C(std::move(f), std::move(args)...);
+        equeue_event_delay(e, ms);
+        equeue_event_period(e, ms);
+        if (!std::is_trivially_destructible<C>::value) {
+            equeue_event_dtor(e, &EventQueue::function_dtor<C>);
+        }
+        return equeue_post(&_equeue, &EventQueue::function_call<C>, e);
     }
 
     /** Calls an event on the queue periodically
      *  @see EventQueue::call_every
      */
-    template <typename T, typename R, typename... ArgTs>
-    int call_every(int ms, volatile T *obj, R(T::*method)(ArgTs...) volatile, ArgTs... args)
+    template <typename T, typename M, typename... ArgTs,
+              typename std::enable_if<std::is_member_function_pointer<M>::value, int>::type = 0>
+    int call_every(int ms, T *obj, M method, ArgTs... args)
     {
-        return call_every(ms, mbed::callback(obj, method), args...);
+        return call_every(ms, mcall<T, M>(obj, method), args...);
     }
 
-    /** Calls an event on the queue periodically
-     *  @see EventQueue::call_every
-     */
-    template <typename T, typename R, typename... ArgTs>
-    int call_every(int ms, const volatile T *obj, R(T::*method)(ArgTs...) const volatile, ArgTs... args)
-    {
-        return call_every(ms, mbed::callback(obj, method), args...);
-    }
+private:
+    // Computes the portion of a callback's signature left unbound by an
+    // event() factory. The first N parameters are bound at creation time
+    // and the remainder become the Event's call signature. The trailing
+    // bool parameter exists only to keep the terminating and recursive
+    // partial specializations unambiguous
+    template <std::size_t N, typename FT, bool = (N == 0)>
+    struct drop_args;
+
+    template <typename... Ps>
+    struct drop_args<0, void(Ps...), true> {
+        using type = void(Ps...);
+    };
+
+    template <std::size_t N, typename P, typename... Ps>
+    struct drop_args<N, void(P, Ps...), false> {
+        using type = typename drop_args<N - 1, void(Ps...)>::type;
+    };
 
+    // Parameter list of a member function pointer as a void signature
+    template <typename M>
+    struct member_params;
+
+    template <typename T, typename R, typename... Ps>
+    struct member_params<R (T::*)(Ps...)> {
+        using type = void(Ps...);
+    };
+
+    template <typename T, typename R, typename... Ps>
+    struct member_params<R (T::*)(Ps...) const> {
+        using type = void(Ps...);
+    };
+
+    template <typename T, typename R, typename... Ps>
+    struct member_params<R (T::*)(Ps...) volatile> {
+        using type = void(Ps...);
+    };
+
+    template <typename T, typename R, typename... Ps>
+    struct member_params<R (T::*)(Ps...) const volatile> {
+        using type = void(Ps...);
+    };
+
+public:
     /** Creates an event bound to the event queue
      *
      *  Constructs an event bound to the specified event queue. The specified
      *  callback acts as the target for the event and is executed in the
      *  context of the event queue's dispatch loop once posted.
      *
+     *  Any context arguments are bound to the callback when the event is
+     *  created, the remaining parameters form the Event's call signature.
+     *
      *  @param func        Function to execute when the event is dispatched
+     *  @param context_args Arguments to bind to the callback
      *  @return            Event that will dispatch on the specific queue
      */
-    template <typename R, typename... ArgTs>
-    Event<void(ArgTs...)> event(R(*func)(ArgTs...));
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename... ArgTs>
-    Event<void(ArgTs...)> event(T *obj, R(T::*method)(ArgTs...));
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename... ArgTs>
-    Event<void(ArgTs...)> event(const T *obj, R(T::*method)(ArgTs...) const);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename... ArgTs>
-    Event<void(ArgTs...)> event(volatile T *obj, R(T::*method)(ArgTs...) volatile);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename... ArgTs>
-    Event<void(ArgTs...)> event(const volatile T *obj, R(T::*method)(ArgTs...) const volatile);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename... ArgTs>
-    Event<void(ArgTs...)> event(mbed::Callback<R(ArgTs...)> cb);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename B0, typename C0, typename... ArgTs>
-    Event<void(ArgTs...)> event(R(*func)(B0, ArgTs...), C0 c0);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename C0, typename... ArgTs>
-    Event<void(ArgTs...)> event(T *obj, R(T::*method)(B0, ArgTs...), C0 c0);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename C0, typename... ArgTs>
-    Event<void(ArgTs...)> event(const T *obj, R(T::*method)(B0, ArgTs...) const, C0 c0);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename C0, typename... ArgTs>
-    Event<void(ArgTs...)> event(volatile T *obj, R(T::*method)(B0, ArgTs...) volatile, C0 c0);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename C0, typename... ArgTs>
-    Event<void(ArgTs...)> event(const volatile T *obj, R(T::*method)(B0, ArgTs...) const volatile, C0 c0);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename B0, typename C0, typename... ArgTs>
-    Event<void(ArgTs...)> event(mbed::Callback<R(B0, ArgTs...)> cb, C0 c0);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-    Event<void(ArgTs...)> event(R(*func)(B0, B1, ArgTs...), C0 c0, C1 c1);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-    Event<void(ArgTs...)> event(T *obj, R(T::*method)(B0, B1, ArgTs...), C0 c0, C1 c1);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-    Event<void(ArgTs...)> event(const T *obj, R(T::*method)(B0, B1, ArgTs...) const, C0 c0, C1 c1);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-    Event<void(ArgTs...)> event(volatile T *obj, R(T::*method)(B0, B1, ArgTs...) volatile, C0 c0, C1 c1);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-    Event<void(ArgTs...)> event(const volatile T *obj, R(T::*method)(B0, B1, ArgTs...) const volatile, C0 c0, C1 c1);
+    template <typename R, typename... Ps, typename... Cs>
+    Event<typename drop_args<sizeof...(Cs), void(Ps...)>::type>
+    event(R(*func)(Ps...), Cs... context_args);
 
     /** Creates an event bound to the event queue
      *  @see EventQueue::event
      */
-    template <typename R, typename B0, typename B1, typename C0, typename C1, typename... ArgTs>
-    Event<void(ArgTs...)> event(mbed::Callback<R(B0, B1, ArgTs...)> cb, C0 c0, C1 c1);
+    template <typename T, typename M, typename... Cs,
+              typename std::enable_if<std::is_member_function_pointer<M>::value, int>::type = 0>
+    Event<typename drop_args<sizeof...(Cs), typename member_params<M>::type>::type>
+    event(T *obj, M method, Cs... context_args);
 
     /** Creates an event bound to the event queue
      *  @see EventQueue::event
      */
-    template <typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-    Event<void(ArgTs...)> event(R(*func)(B0, B1, B2, ArgTs...), C0 c0, C1 c1, C2 c2);
+    template <typename R, typename... Ps, typename... Cs>
+    Event<typename drop_args<sizeof...(Cs), void(Ps...)>::type>
+    event(mbed::Callback<R(Ps...)> cb, Cs... context_args);
 
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-    Event<void(ArgTs...)> event(T *obj, R(T::*method)(B0, B1, B2, ArgTs...), C0 c0, C1 c1, C2 c2);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-    Event<void(ArgTs...)> event(const T *obj, R(T::*method)(B0, B1, B2, ArgTs...) const, C0 c0, C1 c1, C2 c2);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-    Event<void(ArgTs...)> event(volatile T *obj, R(T::*method)(B0, B1, B2, ArgTs...) volatile, C0 c0, C1 c1, C2 c2);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-    Event<void(ArgTs...)> event(const volatile T *obj, R(T::*method)(B0, B1, B2, ArgTs...) const volatile, C0 c0, C1 c1, C2 c2);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename B0, typename B1, typename B2, typename C0, typename C1, typename C2, typename... ArgTs>
-    Event<void(ArgTs...)> event(mbed::Callback<R(B0, B1, B2, ArgTs...)> cb, C0 c0, C1 c1, C2 c2);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-    Event<void(ArgTs...)> event(R(*func)(B0, B1, B2, B3, ArgTs...), C0 c0, C1 c1, C2 c2, C3 c3);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-    Event<void(ArgTs...)> event(T *obj, R(T::*method)(B0, B1, B2, B3, ArgTs...), C0 c0, C1 c1, C2 c2, C3 c3);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-    Event<void(ArgTs...)> event(const T *obj, R(T::*method)(B0, B1, B2, B3, ArgTs...) const, C0 c0, C1 c1, C2 c2, C3 c3);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
+    /** Calculates the buffer space a posted event takes
+     *  @see EventQueue::event_size
      */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-    Event<void(ArgTs...)> event(volatile T *obj, R(T::*method)(B0, B1, B2, B3, ArgTs...) volatile, C0 c0, C1 c1, C2 c2, C3 c3);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-    Event<void(ArgTs...)> event(const volatile T *obj, R(T::*method)(B0, B1, B2, B3, ArgTs...) const volatile, C0 c0, C1 c1, C2 c2, C3 c3);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename B0, typename B1, typename B2, typename B3, typename C0, typename C1, typename C2, typename C3, typename... ArgTs>
-    Event<void(ArgTs...)> event(mbed::Callback<R(B0, B1, B2, B3, ArgTs...)> cb, C0 c0, C1 c1, C2 c2, C3 c3);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-    Event<void(ArgTs...)> event(R(*func)(B0, B1, B2, B3, B4, ArgTs...), C0 c0, C1 c1, C2 c2, C3 c3, C4 c4);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-    Event<void(ArgTs...)> event(T *obj, R(T::*method)(B0, B1, B2, B3, B4, ArgTs...), C0 c0, C1 c1, C2 c2, C3 c3, C4 c4);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-    Event<void(ArgTs...)> event(const T *obj, R(T::*method)(B0, B1, B2, B3, B4, ArgTs...) const, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-    Event<void(ArgTs...)> event(volatile T *obj, R(T::*method)(B0, B1, B2, B3, B4, ArgTs...) volatile, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename T, typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-    Event<void(ArgTs...)> event(const volatile T *obj, R(T::*method)(B0, B1, B2, B3, B4, ArgTs...) const volatile, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4);
-
-    /** Creates an event bound to the event queue
-     *  @see EventQueue::event
-     */
-    template <typename R, typename B0, typename B1, typename B2, typename B3, typename B4, typename C0, typename C1, typename C2, typename C3, typename C4, typename... ArgTs>
-    Event<void(ArgTs...)> event(mbed::Callback<R(B0, B1, B2, B3, B4, ArgTs...)> cb, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4);
+    template <typename F, typename... ContextArgTs>
+    static constexpr size_t event_size()
+    {
+        size_t payload = 2 * sizeof(void *);
+        while (payload < sizeof(context<F, ContextArgTs...>)) {
+            payload *= 2;
+        }
+        return (sizeof(struct equeue_event) + payload + sizeof(void *) - 1)
+               & ~(sizeof(void *) - 1);
+    }
 #endif
 
 protected:
 #if !defined(DOXYGEN_ONLY)
     template <typename F>
     friend class Event;
+    template <typename F, typename... ContextArgTs>
+    friend class UserAllocatedEvent;
     struct equeue _equeue;
     mbed::Callback<void(int)> _update;
 
     // Function attributes
+    //
+    // Note that even an empty callable needs an event allocation, the
+    // allocation is the queue node itself, not just functor storage. A
+    // captureless lambda already lands in the smallest size class and
+    // skips destructor registration, so there is no cheaper path to
+    // special-case stateless callables into
+    //
+    // Each instantiation is the statically compiled form of the partial
+    // application it dispatches, the compiler specializes and inlines
+    // the bound call per context type. Runtime-generated trampolines
+    // could drop the one indirect call left, but need executable RAM,
+    // which the MPU setup on Cortex-M targets deliberately forbids
     template <typename F>
     static void function_call(void *p)
     {
@@ -1090,108 +995,64 @@ protected:
         ((F *)p)->~F();
     }
 
-    // Context structures
-    template <typename F, typename... ContextArgTs>
-    struct context;
+    // Member call context
+    //
+    // Stamps the object and method directly into the event, saving the
+    // construction and dispatch overhead of an intermediate mbed::Callback
+    template <typename T, typename M>
+    struct mcall {
+        T *obj;
+        M method;
 
-    template <typename F>
-    struct context<F> {
-        F f;
-
-        context(F f)
-            : f(f) {}
+        mcall(T *obj, M method)
+            : obj(obj), method(method) {}
 
         template <typename... ArgTs>
-        void operator()(ArgTs... args)
+        MBED_FORCEINLINE void operator()(ArgTs... args)
         {
-            f(args...);
+            (obj->*method)(args...);
         }
     };
 
-    template <typename F, typename C0>
-    struct context<F, C0> {
-        F f;
-        C0 c0;
-
-        context(F f, C0 c0)
-            : f(f), c0(c0) {}
-
-        template <typename... ArgTs>
-        void operator()(ArgTs... args)
-        {
-            f(c0, args...);
-        }
-    };
-
-    template <typename F, typename C0, typename C1>
-    struct context<F, C0, C1> {
-        F f;
-        C0 c0;
-        C1 c1;
-
-        context(F f, C0 c0, C1 c1)
-            : f(f), c0(c0), c1(c1) {}
-
-        template <typename... ArgTs>
-        void operator()(ArgTs... args)
-        {
-            f(c0, c1, args...);
-        }
-    };
-
-    template <typename F, typename C0, typename C1, typename C2>
-    struct context<F, C0, C1, C2> {
-        F f;
-        C0 c0;
-        C1 c1;
-        C2 c2;
-
-        context(F f, C0 c0, C1 c1, C2 c2)
-            : f(f), c0(c0), c1(c1), c2(c2) {}
-
+    // Context structure
+    //
+    // Stores the callback and its bound arguments in a tuple, which
+    // applies the empty base optimization so a captureless callable
+    // contributes no storage to the event. One variadic definition
+    // covers every bound-argument count. Baking compile-time-constant
+    // bound arguments into the thunk itself would need C++17 auto
+    // non-type template parameters, under C++14 the constants are
+    // instead loaded from the event payload at dispatch
+    template <typename F, typename... ContextArgTs>
+    struct context {
+        std::tuple<F, ContextArgTs...> data;
+
+        // forwarding constructor so moved-in callables and arguments
+        // reach the tuple without an extra copy, constrained so it
+        // never outcompetes the copy constructor
+        template <typename Ff, typename... Cs,
+                  typename std::enable_if<(sizeof...(Cs) > 0) ||
+                                          !std::is_same<typename std::decay<Ff>::type, context>::value, int>::type = 0>
+        context(Ff &&f, Cs &&... args)
+            : data(std::forward<Ff>(f), std::forward<Cs>(args)...) {}
+
+        // forced inline so the unpacking collapses into the dispatch
+        // thunk, leaving loads of the bound arguments and the target
+        // call rather than a chain of helper frames at -Os
         template <typename... ArgTs>
-        void operator()(ArgTs... args)
+        MBED_FORCEINLINE void operator()(ArgTs... args)
         {
-            f(c0, c1, c2, args...);
+            call(std::make_index_sequence<sizeof...(ContextArgTs)>(), args...);
         }
-    };
-
-    template <typename F, typename C0, typename C1, typename C2, typename C3>
-    struct context<F, C0, C1, C2, C3> {
-        F f;
-        C0 c0;
-        C1 c1;
-        C2 c2;
-        C3 c3;
 
-        context(F f, C0 c0, C1 c1, C2 c2, C3 c3)
-            : f(f), c0(c0), c1(c1), c2(c2), c3(c3) {}
-
-        template <typename... ArgTs>
-        void operator()(ArgTs... args)
+    private:
+        template <std::size_t... I, typename... ArgTs>
+        MBED_FORCEINLINE void call(std::index_sequence<I...>, ArgTs... args)
         {
-            f(c0, c1, c2, c3, args...);
+            std::get<0>(data)(std::get<I + 1>(data)..., args...);
         }
     };
 
-    template <typename F, typename C0, typename C1, typename C2, typename C3, typename C4>
-    struct context<F, C0, C1, C2, C3, C4> {
-        F f;
-        C0 c0;
-        C1 c1;
-        C2 c2;
-        C3 c3;
-        C4 c4;
-
-        context(F f, C0 c0, C1 c1, C2 c2, C3 c3, C4 c4)
-            : f(f), c0(c0), c1(c1), c2(c2), c3(c3), c4(c4) {}
-
-        template <typename... ArgTs>
-        void operator()(ArgTs... args)
-        {
-            f(c0, c1, c2, c3, c4, args...);
-        }
-    };
 #endif //!defined(DOXYGEN_ONLY)
 };
 
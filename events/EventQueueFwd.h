@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EVENT_QUEUE_FWD_H
+#define EVENT_QUEUE_FWD_H
+
+namespace events {
+/**
+ * \addtogroup events-public-api
+ * @{
+ */
+
+/* Forward declarations of the events types, for headers that only pass
+ * EventQueue or Event by pointer or reference. Including this instead of
+ * EventQueue.h keeps the Callback and placement-new machinery out of
+ * translation units that never post events themselves.
+ */
+class EventQueue;
+
+template <typename F>
+class Event;
+
+/** @}*/
+
+}
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 ARM Limited
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef USER_ALLOCATED_EVENT_H
+#define USER_ALLOCATED_EVENT_H
+
+#include "events/EventQueue.h"
+#include <cstring>
+
+namespace events {
+/**
+ * \addtogroup events-public-api
+ * @{
+ */
+
+/** UserAllocatedEvent
+ *
+ *  Representation of an event with embedded storage. The underlying
+ *  equeue event and the bound callback live inside this object, so
+ *  posting takes no memory from the queue's buffer and cannot fail
+ *  for lack of memory.
+ *
+ *  The object owns the event's storage: it must outlive the dispatch
+ *  of a posted event, and a posted event must be dispatched or
+ *  successfully cancelled before it can be posted again.
+ */
+template <typename F, typename... ContextArgTs>
+class UserAllocatedEvent {
+public:
+    /** Create an event with embedded storage
+     *
+     *  Constructs an event and binds the callback and its arguments
+     *  inside the object. The event is not associated with a queue
+     *  until it is posted.
+     *
+     *  @param f               Function to execute when the event is dispatched
+     *  @param context_args    Arguments to bind to the callback
+     */
+    UserAllocatedEvent(F f, ContextArgTs... context_args) :
+        _c(std::move(f), std::move(context_args)...),
+        _equeue(0), _delay(0), _period(-1)
+    {
+        memset(&_e, 0, sizeof(_e));
+    }
+
+    UserAllocatedEvent(const UserAllocatedEvent &) = delete;
+    UserAllocatedEvent &operator=(const UserAllocatedEvent &) = delete;
+
+    // Movable only while not posted, the queue's links point into the
+    // object once it has been posted
+    UserAllocatedEvent(UserAllocatedEvent &&) = default;
+
+    /** Destructor for events
+     *
+     *  Cancels any pending post, the storage disappears with the object
+     */
+    ~UserAllocatedEvent()
+    {
+        cancel();
+    }
+
+    /** Configure the delay of an event
+     *
+     *  @param delay    Millisecond delay before dispatching the event
+     */
+    void delay(int delay)
+    {
+        _delay = delay;
+    }
+
+    /** Configure the period of an event
+     *
+     *  @param period   Millisecond period for repeatedly dispatching an event
+     */
+    void period(int period)
+    {
+        _period = period;
+    }
+
+    /** Posts the event onto an event queue
+     *
+     *  The event is linked into the queue in place and is executed in
+     *  the context of the event queue's dispatch loop with the bound
+     *  arguments.
+     *
+     *  The call_on function is IRQ safe and, unlike EventQueue::call,
+     *  cannot fail for lack of queue memory. The event must not
+     *  already be pending.
+     *
+     *  @param queue    Event queue to dispatch on
+     */
+    void call_on(EventQueue *queue)
+    {
+        _equeue = &queue->_equeue;
+        _e.target = _delay;
+        _e.period = _period;
+        equeue_post_user_allocated(_equeue,
+                                   &UserAllocatedEvent::event_call, &_e);
+    }
+
+    /** Cancels a posted event
+     *
+     *  Attempts to cancel the posted event. It is safe to call cancel
+     *  after an event has already been dispatched.
+     *
+     *  The cancel function is IRQ safe.
+     *
+     *  @return         true if the event was successfully cancelled,
+     *                  false if the event already began executing or
+     *                  was never posted
+     */
+    bool cancel()
+    {
+        return _equeue ? equeue_cancel_user_allocated(_equeue, &_e) : false;
+    }
+
+    /** Query how much time is left until the event is dispatched
+     *
+     *  This function is IRQ safe.
+     *
+     *  @return         Remaining time in milliseconds, or a negative
+     *                  value if the event was never posted
+     */
+    int time_left()
+    {
+        return _equeue ? equeue_timeleft_user_allocated(_equeue, &_e) : -1;
+    }
+
+private:
+    static void event_call(void *p)
+    {
+        (*static_cast<EventQueue::context<F, ContextArgTs...> *>(p))();
+    }
+
+    // The bound call must immediately follow the event header,
+    // mirroring the layout equeue's own allocator produces for
+    // queue-owned events. Dispatch hands the callback the address
+    // right after the header, so an over-aligned binding that would
+    // force padding between the two members must not compile
+    static_assert(sizeof(struct equeue_event) %
+                  alignof(EventQueue::context<F, ContextArgTs...>) == 0,
+                  "the bound call's alignment would pad it away from the event header");
+    struct equeue_event _e;
+    EventQueue::context<F, ContextArgTs...> _c;
+    equeue_t *_equeue;
+    int _delay;
+    int _period;
+};
+
+/** Creates an event with embedded storage
+ *  @see UserAllocatedEvent
+ *  @param f               Function to execute when the event is dispatched
+ *  @param context_args    Arguments to bind to the callback
+ *  @return                UserAllocatedEvent with the callback bound
+ */
+template <typename F, typename... ContextArgTs>
+UserAllocatedEvent<F, ContextArgTs...> make_user_allocated_event(F f, ContextArgTs... context_args)
+{
+    return UserAllocatedEvent<F, ContextArgTs...>(std::move(f), std::move(context_args)...);
+}
+
+/** Creates an event with embedded storage
+ *  @see UserAllocatedEvent
+ */
+template <typename T, typename M, typename... ContextArgTs,
+          typename std::enable_if<std::is_member_function_pointer<M>::value, int>::type = 0>
+UserAllocatedEvent<decltype(mbed::callback(std::declval<T *>(), std::declval<M>())), ContextArgTs...>
+make_user_allocated_event(T *obj, M method, ContextArgTs... context_args)
+{
+    return UserAllocatedEvent<decltype(mbed::callback(obj, method)), ContextArgTs...>(
+               mbed::callback(obj, method), std::move(context_args)...);
+}
+
+/** @}*/
+
+}
+
+#endif
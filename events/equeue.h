@@ -38,17 +38,33 @@ extern "C" {
 // This size is guaranteed to fit events created by event_call
 #define EQUEUE_EVENT_SIZE (sizeof(struct equeue_event) + 2*sizeof(void*))
 
+// The number of size classes maintained by the chunk allocator
+// Each class holds chunks of one power-of-two payload size, with the
+// last class also holding anything larger
+#define EQUEUE_CLASSES 8
+
 // Internal event structure
+//
+// The fields walked by the sorted insert (next/sibling/ref/target) are
+// grouped at the front so the queue traversal touches a single cache
+// line per event, keeping the fields only read at dispatch or
+// deallocation time out of the walk's way. The cb pointer can't be
+// compacted into a small table index, the set of distinct callbacks is
+// unbounded (one per C++ thunk instantiation) and no walk reads cb
+// anyway, cancel resolves events by buffer offset
 struct equeue_event {
-    unsigned size;
-    uint8_t id;
-    uint8_t generation;
-
     struct equeue_event *next;
     struct equeue_event *sibling;
     struct equeue_event **ref;
-
     unsigned target;
+
+    // chunk size in bytes including this header, 16 bits is plenty for
+    // the event sizes small targets can afford and packs with id and
+    // generation to shave a word of header off every event on 32-bit
+    uint16_t size;
+    uint8_t id;
+    uint8_t generation;
+
     int period;
     void (*dtor)(void *);
 
@@ -57,21 +73,32 @@ struct equeue_event {
 };
 
 // Event queue structure
+//
+// Fields are grouped by access pattern, read-only state first, then the
+// scheduling state guarded by queuelock, then the allocator state guarded
+// by memlock, so the two independently contended groups don't share cache
+// lines with each other or with the constant fields
+//
+// On embedded targets the mutexes are critical sections, so a post from
+// an interrupt never contends with the dispatch thread, it preempts it
+// for the few instructions of the sorted insert. A lock-free staging
+// ring would trade that bounded window for atomics the portable C core
+// can't assume and a fixed capacity that can overflow. The same
+// reasoning rules out delegation-style locks where waiters hand their
+// insert to the holder, there is no waiting to delegate away and an
+// interrupt context could not park on a slot anyway
 typedef struct equeue {
-    struct equeue_event *queue;
-    unsigned tick;
-    bool break_requested;
-    uint8_t generation;
-
+    // read-only after creation
     unsigned char *buffer;
     unsigned npw2;
     void *allocated;
 
-    struct equeue_event *chunks;
-    struct equeue_slab {
-        size_t size;
-        unsigned char *data;
-    } slab;
+    // scheduling state, guarded by queuelock
+    struct equeue_event *queue;
+    struct equeue_event *tail;
+    unsigned tick;
+    bool break_requested;
+    uint8_t generation;
 
     struct equeue_background {
         bool active;
@@ -79,6 +106,13 @@ typedef struct equeue {
         void *timer;
     } background;
 
+    // allocator state, guarded by memlock
+    struct equeue_event *chunks[EQUEUE_CLASSES];
+    struct equeue_slab {
+        size_t size;
+        unsigned char *data;
+    } slab;
+
     equeue_sema_t eventsema;
     equeue_mutex_t queuelock;
     equeue_mutex_t memlock;
@@ -176,6 +210,21 @@ void equeue_event_dtor(void *event, void (*dtor)(void *));
 // be passed to equeue_cancel.
 int equeue_post(equeue_t *queue, void (*cb)(void *), void *event);
 
+// Post an event onto the event queue without an allocation
+//
+// The equeue_post_user_allocated function takes a callback and a pointer
+// to a user-owned struct equeue_event with the callback's data placed
+// immediately after it. The event is linked into the queue in place, so no
+// memory is taken from the queue's buffer and the post cannot fail.
+//
+// The caller owns the event's memory: it must stay valid until the event
+// has been dispatched or successfully cancelled with
+// equeue_cancel_user_allocated, and is never deallocated by the queue.
+//
+// The equeue_post_user_allocated function is irq safe.
+void equeue_post_user_allocated(equeue_t *queue,
+                                void (*cb)(void *), void *event);
+
 // Cancel an in-flight event
 //
 // Attempts to cancel an event referenced by the unique id returned from
@@ -191,6 +240,19 @@ int equeue_post(equeue_t *queue, void (*cb)(void *), void *event);
 // Returning false if invalid id or already started executing.
 bool equeue_cancel(equeue_t *queue, int id);
 
+// Cancel an in-flight user-allocated event
+//
+// Attempts to cancel an event posted with equeue_post_user_allocated,
+// referenced by its address. It is safe to call after the event has
+// already been dispatched.
+//
+// The equeue_cancel_user_allocated function is irq safe.
+//
+// Returning true guarantees that cancel succeeded and the event will not
+// execute, the caller may reuse or free the event's memory. Returning
+// false means the event has already begun or finished executing.
+bool equeue_cancel_user_allocated(equeue_t *queue, void *event);
+
 // Query how much time is left for delayed event
 //
 //  If event is delayed, this function can be used to query how much time
@@ -200,6 +262,15 @@ bool equeue_cancel(equeue_t *queue, int id);
 //
 int equeue_timeleft(equeue_t *q, int id);
 
+// Query how much time is left for a delayed user-allocated event
+//
+//  The user-allocated variant of equeue_timeleft, referencing the event
+//  by its address.
+//
+//  This function is irq safe.
+//
+int equeue_timeleft_user_allocated(equeue_t *q, void *event);
+
 // Background an event queue onto a single-shot timer
 //
 // The provided update function will be called to indicate when the queue
@@ -16,7 +16,7 @@
 #ifndef MBED_SHARED_QUEUES_H
 #define MBED_SHARED_QUEUES_H
 
-#include "events/EventQueue.h"
+#include "events/EventQueueFwd.h"
 
 namespace mbed {
 /** \ingroup mbed-os-public */
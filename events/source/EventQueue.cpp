@@ -65,6 +65,11 @@ void EventQueue::background(Callback<void(int)> update)
     _update = update;
 
     if (_update) {
+        // equeue stores a raw function/context pair, so the timer path is a
+        // single plain function-pointer call into the Callback's static
+        // thunk. The stored Callback is the context: it owns whatever target
+        // was bound (member function, functor), which is why it can't be
+        // decomposed into two raw words here
         equeue_background(&_equeue, &Callback<void(int)>::thunk, &_update);
     } else {
         equeue_background(&_equeue, 0, 0);
@@ -79,4 +84,9 @@ int EventQueue::chain(EventQueue *target)
         return equeue_chain(&_equeue, 0);
     }
 }
+
+// Out-of-line instantiations for the common event shapes declared
+// extern in Event.h
+template class Event<void()>;
+template class Event<void(int)>;
 }
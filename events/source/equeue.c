@@ -75,11 +75,12 @@ int equeue_create_inplace(equeue_t *q, size_t size, void *buffer)
         q->npw2++;
     }
 
-    q->chunks = 0;
+    memset(q->chunks, 0, sizeof(q->chunks));
     q->slab.size = size;
     q->slab.data = q->buffer;
 
     q->queue = 0;
+    q->tail = 0;
     equeue_tick_init();
     q->tick = equeue_tick();
     q->generation = 0;
@@ -135,17 +136,62 @@ void equeue_destroy(equeue_t *q)
 }
 
 
+// map a chunk payload to its size class, the last class also
+// holds anything larger
+static unsigned equeue_class(size_t payload)
+{
+#if defined(__GNUC__)
+    // payload is always a power of two no smaller than the smallest
+    // class, so the class index is the difference of the exponents
+    unsigned sc = __builtin_clzl(2 * sizeof(void *)) -
+                  __builtin_clzl((unsigned long)payload);
+    return (sc < EQUEUE_CLASSES - 1) ? sc : EQUEUE_CLASSES - 1;
+#else
+    unsigned sc = 0;
+    for (size_t p = 2 * sizeof(void *); p < payload && sc < EQUEUE_CLASSES - 1; p <<= 1) {
+        sc += 1;
+    }
+    return sc;
+#endif
+}
+
 // equeue chunk allocation functions
 static struct equeue_event *equeue_mem_alloc(equeue_t *q, size_t size)
 {
+    // round the payload up to a power-of-two size class, with the smallest
+    // class fitting events created by equeue_call, this keeps the number of
+    // distinct chunk sizes small so freed chunks are much more likely to be
+    // reused directly
+    size_t payload = 2 * sizeof(void *);
+#if defined(__GNUC__)
+    if (size > payload) {
+        payload = (size_t)1 << (8 * sizeof(unsigned long) -
+                                __builtin_clzl((unsigned long)size - 1));
+    }
+#else
+    while (payload < size) {
+        payload <<= 1;
+    }
+#endif
+
+    unsigned sc = equeue_class(payload);
+
     // add event overhead
-    size += sizeof(struct equeue_event);
+    size = payload + sizeof(struct equeue_event);
     size = (size + sizeof(void *) -1) & ~(sizeof(void *) -1);
 
+    // the chunk size is stored in a 16-bit field, treat anything larger
+    // as an allocation failure rather than truncating
+    if (size > UINT16_MAX) {
+        return 0;
+    }
+
     equeue_mutex_lock(&q->memlock);
 
-    // check if a good chunk is available
-    for (struct equeue_event **p = &q->chunks; *p; p = &(*p)->next) {
+    // check if a good chunk is available, chunks in all but the last
+    // class are the same size so this pops the head in constant time,
+    // bounding the critical section for posts from interrupt context
+    for (struct equeue_event **p = &q->chunks[sc]; *p; p = &(*p)->next) {
         if ((*p)->size >= size) {
             struct equeue_event *e = *p;
             if (e->sibling) {
@@ -161,11 +207,17 @@ static struct equeue_event *equeue_mem_alloc(equeue_t *q, size_t size)
     }
 
     // otherwise allocate a new chunk out of the slab
+    //
+    // the slab carve is a plain bump pointer, but unlike a resettable
+    // arena it is never rewound, cancelled and periodic events free
+    // their chunks in arbitrary order and at arbitrary times, so there
+    // is no point at which the whole region is known to be empty,
+    // freed chunks are instead recycled through the class lists above
     if (q->slab.size >= size) {
         struct equeue_event *e = (struct equeue_event *)q->slab.data;
         q->slab.data += size;
         q->slab.size -= size;
-        e->size = size;
+        e->size = (uint16_t)size;
         e->id = 1;
 
         equeue_mutex_unlock(&q->memlock);
@@ -178,10 +230,12 @@ static struct equeue_event *equeue_mem_alloc(equeue_t *q, size_t size)
 
 static void equeue_mem_dealloc(equeue_t *q, struct equeue_event *e)
 {
+    unsigned sc = equeue_class(e->size - sizeof(struct equeue_event));
+
     equeue_mutex_lock(&q->memlock);
 
-    // stick chunk into list of chunks
-    struct equeue_event **p = &q->chunks;
+    // stick chunk into its class's list of chunks
+    struct equeue_event **p = &q->chunks[sc];
     while (*p && (*p)->size < e->size) {
         p = &(*p)->next;
     }
@@ -225,7 +279,16 @@ void equeue_dealloc(equeue_t *q, void *p)
 
 
 // equeue scheduling functions
-static int equeue_enqueue(equeue_t *q, struct equeue_event *e, unsigned tick)
+//
+// Delayed events are kept in a list sorted by target tick, with events
+// due at the same tick chained off a shared slot as siblings. A timing
+// wheel would make inserts O(1), but its bucket heads alone cost more
+// RAM than a typical equeue buffer and it can't provide the ordered
+// head needed by the dispatch cutoff and the background timer. The
+// insert walk is instead bounded by the number of distinct deadlines,
+// and in-order posts append at the tail in O(1).
+static int equeue_enqueue(equeue_t *q, struct equeue_event *e, unsigned tick,
+                          bool *head)
 {
     // setup event and hash local id with buffer offset for unique id
     int id = (e->id << q->npw2) | ((unsigned char *)e - q->buffer);
@@ -234,8 +297,19 @@ static int equeue_enqueue(equeue_t *q, struct equeue_event *e, unsigned tick)
 
     equeue_mutex_lock(&q->queuelock);
 
-    // find the event slot
+    // find the event slot, starting from the tail when the event belongs
+    // at or past the end of the queue, so in-order posts avoid walking
+    // the earlier events
     struct equeue_event **p = &q->queue;
+    if (q->tail) {
+        int tdiff = equeue_tickdiff(e->target, q->tail->target);
+        if (tdiff > 0) {
+            p = &q->tail->next;
+        } else if (tdiff == 0) {
+            p = q->tail->ref;
+        }
+    }
+
     while (*p && equeue_tickdiff((*p)->target, e->target) < 0) {
         p = &(*p)->next;
     }
@@ -261,6 +335,17 @@ static int equeue_enqueue(equeue_t *q, struct equeue_event *e, unsigned tick)
     *p = e;
     e->ref = p;
 
+    // track the last event in the queue
+    if (!e->next) {
+        q->tail = e;
+    }
+
+    // we're the new head if we were inserted at the front of the queue
+    // with no other event already due at the same tick
+    if (head) {
+        *head = (q->queue == e && !e->sibling);
+    }
+
     // notify background timer
     if ((q->background.update && q->background.active) &&
             (q->queue == e && !e->sibling)) {
@@ -273,26 +358,17 @@ static int equeue_enqueue(equeue_t *q, struct equeue_event *e, unsigned tick)
     return id;
 }
 
-static struct equeue_event *equeue_unqueue(equeue_t *q, int id)
+// unlink an event from the queue, the queuelock must be held, returns
+// false if the event is already in-flight
+static bool equeue_unqueue_raw(equeue_t *q, struct equeue_event *e)
 {
-    // decode event from unique id and check that the local id matches
-    struct equeue_event *e = (struct equeue_event *)
-                             &q->buffer[id & ((1 << q->npw2) - 1)];
-
-    equeue_mutex_lock(&q->queuelock);
-    if (e->id != id >> q->npw2) {
-        equeue_mutex_unlock(&q->queuelock);
-        return 0;
-    }
-
     // clear the event and check if already in-flight
     e->cb = 0;
     e->period = -1;
 
     int diff = equeue_tickdiff(e->target, q->tick);
     if (diff < 0 || (diff == 0 && e->generation != q->generation)) {
-        equeue_mutex_unlock(&q->queuelock);
-        return 0;
+        return false;
     }
 
     // disentangle from queue
@@ -311,12 +387,47 @@ static struct equeue_event *equeue_unqueue(equeue_t *q, int id)
         }
     }
 
+    // update the tail, falling back to a full walk on the next enqueue
+    // if we can't cheaply find the new last event
+    if (q->tail == e) {
+        q->tail = e->sibling;
+    }
+
+    return true;
+}
+
+// Resolve an id to its event and unlink it. The id encodes the event's
+// buffer offset, so no scan of the queue is needed, the candidate is
+// found by address arithmetic and validated against the stored local id
+static struct equeue_event *equeue_unqueue(equeue_t *q, int id)
+{
+    // decode event from unique id and check that the local id matches,
+    // the id embeds the event's buffer offset so the lookup is constant
+    // time with no list walk, and the local id acts as a generation
+    // counter that catches stale ids after the chunk has been reused
+    struct equeue_event *e = (struct equeue_event *)
+                             &q->buffer[id & ((1 << q->npw2) - 1)];
+
+    equeue_mutex_lock(&q->queuelock);
+    if (e->id != id >> q->npw2) {
+        equeue_mutex_unlock(&q->queuelock);
+        return 0;
+    }
+
+    if (!equeue_unqueue_raw(q, e)) {
+        equeue_mutex_unlock(&q->queuelock);
+        return 0;
+    }
+
     equeue_incid(q, e);
     equeue_mutex_unlock(&q->queuelock);
 
     return e;
 }
 
+// Splice every event due at the target tick off the queue in a single
+// critical section, the dispatch loop then executes the batch without
+// holding any lock
 static struct equeue_event *equeue_dequeue(equeue_t *q, unsigned target)
 {
     equeue_mutex_lock(&q->queuelock);
@@ -336,6 +447,8 @@ static struct equeue_event *equeue_dequeue(equeue_t *q, unsigned target)
     q->queue = *p;
     if (q->queue) {
         q->queue->ref = &q->queue;
+    } else {
+        q->tail = 0;
     }
 
     *p = 0;
@@ -369,11 +482,35 @@ int equeue_post(equeue_t *q, void (*cb)(void *), void *p)
     e->cb = cb;
     e->target = tick + e->target;
 
-    int id = equeue_enqueue(q, e, tick);
-    equeue_sema_signal(&q->eventsema);
+    // only wake the dispatch loop when the event moved the earliest
+    // deadline, otherwise the dispatch loop is already due to wake
+    // soon enough, this keeps a burst of posts down to a single signal
+    bool head;
+    int id = equeue_enqueue(q, e, tick, &head);
+    if (head) {
+        equeue_sema_signal(&q->eventsema);
+    }
     return id;
 }
 
+void equeue_post_user_allocated(equeue_t *q, void (*cb)(void *), void *p)
+{
+    struct equeue_event *e = (struct equeue_event *)p;
+    unsigned tick = equeue_tick();
+    e->cb = cb;
+    e->target = tick + e->target;
+
+    // a local id of 0 never comes out of the chunk allocator, marking
+    // the event as user-owned so dispatch won't try to deallocate it
+    e->id = 0;
+
+    bool head;
+    equeue_enqueue(q, e, tick, &head);
+    if (head) {
+        equeue_sema_signal(&q->eventsema);
+    }
+}
+
 bool equeue_cancel(equeue_t *q, int id)
 {
     if (!id) {
@@ -389,6 +526,35 @@ bool equeue_cancel(equeue_t *q, int id)
     }
 }
 
+bool equeue_cancel_user_allocated(equeue_t *q, void *p)
+{
+    if (!p) {
+        return false;
+    }
+
+    struct equeue_event *e = (struct equeue_event *)p;
+
+    equeue_mutex_lock(&q->queuelock);
+    bool unqueued = equeue_unqueue_raw(q, e);
+    equeue_mutex_unlock(&q->queuelock);
+
+    return unqueued;
+}
+
+int equeue_timeleft_user_allocated(equeue_t *q, void *p)
+{
+    if (!p) {
+        return -1;
+    }
+
+    struct equeue_event *e = (struct equeue_event *)p;
+
+    equeue_mutex_lock(&q->queuelock);
+    int ret = equeue_clampdiff(e->target, equeue_tick());
+    equeue_mutex_unlock(&q->queuelock);
+    return ret;
+}
+
 int equeue_timeleft(equeue_t *q, int id)
 {
     int ret = -1;
@@ -432,16 +598,29 @@ void equeue_dispatch(equeue_t *q, int ms)
             struct equeue_event *e = es;
             es = e->next;
 
+#if defined(__GNUC__)
+            // pull the next event's header and callback data towards the
+            // cache while the current callback runs
+            if (es) {
+                __builtin_prefetch(es, 0, 1);
+                __builtin_prefetch(es + 1, 0, 0);
+            }
+#endif
+
             // actually dispatch the callbacks
             void (*cb)(void *) = e->cb;
             if (cb) {
                 cb(e + 1);
             }
 
-            // reenqueue periodic events or deallocate
+            // reenqueue periodic events or deallocate, the periodic
+            // re-arm reuses the event's chunk in place, so a repeating
+            // event costs no allocator traffic after its initial post
             if (e->period >= 0) {
                 e->target += e->period;
-                equeue_enqueue(q, e, equeue_tick());
+                equeue_enqueue(q, e, equeue_tick(), 0);
+            } else if (e->id == 0) {
+                // user-allocated event, the caller owns the memory
             } else {
                 equeue_incid(q, e);
                 equeue_dealloc(q, e + 1);
@@ -592,6 +771,10 @@ void equeue_background(equeue_t *q,
     equeue_mutex_unlock(&q->queuelock);
 }
 
+// Chaining never moves events between queues. Events stay in their own
+// queue's buffer and id domain, the target only carries one small
+// dispatch trigger per wakeup of the chained queue, so per-event
+// allocator and lock traffic is not doubled by a chain
 struct equeue_chain_context {
     equeue_t *q;
     equeue_t *target;
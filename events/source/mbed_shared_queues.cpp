@@ -15,6 +15,7 @@
  */
 
 #include "events/mbed_shared_queues.h"
+#include "events/EventQueue.h"
 
 #ifdef MBED_CONF_RTOS_PRESENT
 #include "rtos/Thread.h"
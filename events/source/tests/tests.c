@@ -21,6 +21,7 @@
 #include <setjmp.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <pthread.h>
 
 
@@ -208,6 +209,36 @@ void simple_post_test(void)
     equeue_destroy(&q);
 }
 
+void user_allocated_test(void)
+{
+    equeue_t q;
+    int err = equeue_create(&q, EQUEUE_EVENT_SIZE);
+    test_assert(!err);
+
+    struct user_event {
+        struct equeue_event e;
+        bool touched;
+    } e1, e2;
+
+    memset(&e1, 0, sizeof(e1));
+    e1.e.period = -1;
+
+    memset(&e2, 0, sizeof(e2));
+    e2.e.target = 10;
+    e2.e.period = -1;
+
+    equeue_post_user_allocated(&q, simple_func, &e1.e);
+    equeue_post_user_allocated(&q, simple_func, &e2.e);
+    test_assert(equeue_timeleft_user_allocated(&q, &e2.e) > 0);
+    test_assert(equeue_cancel_user_allocated(&q, &e2.e));
+
+    equeue_dispatch(&q, 0);
+    test_assert(e1.touched);
+    test_assert(!e2.touched);
+
+    equeue_destroy(&q);
+}
+
 // Misc tests
 void destructor_test(void)
 {
@@ -810,6 +841,7 @@ int main()
     test_run(simple_call_in_test);
     test_run(simple_call_every_test);
     test_run(simple_post_test);
+    test_run(user_allocated_test);
     test_run(destructor_test);
     test_run(allocation_failure_test);
     test_run(cancel_test, 20);
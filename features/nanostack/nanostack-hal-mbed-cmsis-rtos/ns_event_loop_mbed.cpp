@@ -28,6 +28,7 @@
 
 #include "mbed_error.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 #include "events/Event.h"
 #include "ns_event_loop_mutex.h"
 #include "ns_event_loop.h"
@@ -24,6 +24,7 @@
 #include "mbed_assert.h"
 #include "netsocket/nsapi_types.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 
 #include "smsc9220_emac.h"
 #include "smsc9220_eth_drv.h"
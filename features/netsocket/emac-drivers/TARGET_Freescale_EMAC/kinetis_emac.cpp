@@ -41,6 +41,7 @@
 #include "mbed_assert.h"
 #include "netsocket/nsapi_types.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 
 #include "fsl_phy.h"
 
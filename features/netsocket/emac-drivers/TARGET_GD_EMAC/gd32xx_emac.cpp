@@ -23,6 +23,7 @@
 #include "mbed_interface.h"
 #include "mbed_assert.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 #include "netsocket/nsapi_types.h"
 
 #include "gd32xx_emac.h"
@@ -29,6 +29,7 @@
 #include "mbed_assert.h"
 #include "netsocket/nsapi_types.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 
 //#define NU_TRACE
 
@@ -19,6 +19,7 @@
 #include "mbed_interface.h"
 #include "mbed_assert.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 #include "netsocket/nsapi_types.h"
 #include "lwip/arch.h"
 #include "lwip/pbuf.h"
@@ -17,6 +17,7 @@
 #include "rtos/ThisThread.h"
 #include "netsocket/nsapi_types.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 #include "ethernet_api.h"
 #include "ethernetext_api.h"
 #include "rza1_emac.h"
@@ -25,6 +25,7 @@
 #include "lwip/etharp.h"
 #include "lwip/ethip6.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 #include "whd_wlioctl.h"
 #include "whd_buffer_api.h"
 #include "cybsp_api_wifi.h"
@@ -23,6 +23,7 @@
 
 #if PPP_MBED_EVENT_QUEUE
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 #else
 #include "Thread.h"
 #include "EventQueue.h"
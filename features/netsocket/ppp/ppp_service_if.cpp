@@ -21,6 +21,7 @@
 #include "mbed_trace.h"
 #include "netsocket/nsapi_types.h"
 #include "mbed_shared_queues.h"
+#include "events/EventQueue.h"
 #include "mbed_poll.h"
 #include "ip4string.h"
 #include "ip6string.h"